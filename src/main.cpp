@@ -7,6 +7,18 @@
 #include <vector>
 #include <random>
 #include <cmath>
+#include <cerrno>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+// POSIX sockets for the spectator stream
+#include <sys/socket.h>
+#include <netinet/in.h>
+#include <arpa/inet.h>
+#include <fcntl.h>
+#include <unistd.h>
 
 // Global variables to manage game state, positions, and NPC behaviors
 float xoffset = 0.9f; // Horizontal position offset for the player
@@ -618,6 +630,518 @@ void resetGame() {
     resetNPCPositions();
 }
 
+// ---------------------------------------------------------------------------
+// Spectator stream
+//
+// The game can broadcast its per-tick state over UDP so a spectator client can
+// watch it live. Every packet carries the score, level, flags and player
+// position; NPC positions are quantized to 16-bit fixed point and sent either
+// as a keyframe (full entity list with colors) or as a delta against the
+// previous tick (only NPCs that moved, as zigzag varints). A spectator that
+// misses a packet ignores deltas until the next keyframe arrives.
+// ---------------------------------------------------------------------------
+
+const int kSpectatorDefaultPort = 7777; // Default UDP port for the spectator stream
+const int kSpectatorKeyframeInterval = 30; // Ticks between forced keyframes
+const int kSpectatorMaxPacket = 1400; // Stay below a typical Ethernet MTU
+const int kSpectatorMaxEntities = 160; // Keyframe entities that fit in one packet
+const float kSpectatorPosScale = 2048.0f; // Position quantization steps per unit
+const float kSpectatorSizeScale = 1024.0f; // Size quantization steps per unit
+const double kSpectatorInterpDelayMs = 100.0; // How far behind the stream the client renders
+const double kSpectatorHistoryMarginMs = 200.0; // Snapshots older than the render time kept for blending
+const double kSpectatorTimeoutMs = 1000.0; // Silence after which the client shows the waiting screen
+const int kSpectatorGameOverResends = 3; // Extra keyframes sent before the game exits on game over
+const uint8_t kSpectatorKeyframe = 0; // Packet kind: full snapshot
+const uint8_t kSpectatorDelta = 1; // Packet kind: changes since the previous tick
+
+// Quantized NPC as sent over the wire
+struct SpectatorEntity {
+    int16_t x, y;       // Position in 1/kSpectatorPosScale units
+    uint8_t size;       // Size in 1/kSpectatorSizeScale units
+    uint8_t r, g, b;    // Color
+};
+
+// One tick of game state as seen by a spectator
+struct SpectatorSnapshot {
+    uint32_t session = 0;     // Random id of the game process that sent it
+    uint32_t tick = 0;        // Server tick counter
+    uint32_t serverMs = 0;    // Server clock when the tick was sent
+    uint8_t epoch = 0;        // Changes whenever the entity list is rebuilt
+    bool spacePressed = false;
+    bool gameOver = false;
+    int score = 0;
+    int level = 1;
+    int16_t playerX = 0, playerY = 0; // Player offsets, quantized like positions
+    std::vector<SpectatorEntity> entities;
+};
+
+int spectatorSocket = -1; // UDP socket used by either the server or the client
+sockaddr_in spectatorTarget; // Where the server sends its snapshots
+SpectatorSnapshot spectatorLastSent; // Baseline for the next delta
+bool spectatorHaveBaseline = false; // False until a keyframe has been sent successfully
+const std::vector<NPC>* spectatorLastPattern = nullptr; // Pattern the baseline was built from
+uint32_t spectatorTick = 0; // Server tick counter
+uint32_t spectatorSession = 0; // Random id so spectators notice a new game process
+
+// Function to quantize a coordinate into the 16-bit wire format
+int16_t quantizePosition(float v) {
+    float q = std::round(v * kSpectatorPosScale);
+    if (q > 32767.0f) q = 32767.0f; // NPCs that fell far off screen saturate
+    if (q < -32768.0f) q = -32768.0f;
+    return (int16_t)q;
+}
+
+// Function to quantize a 0..1 color channel or NPC size into one byte
+uint8_t quantizeByte(float v, float scale) {
+    float q = std::round(v * scale);
+    if (q > 255.0f) q = 255.0f;
+    if (q < 0.0f) q = 0.0f;
+    return (uint8_t)q;
+}
+
+// Functions to append values to a packet; they return false when it is full
+bool writeByte(std::vector<uint8_t>& buf, uint8_t v) {
+    if ((int)buf.size() >= kSpectatorMaxPacket) return false;
+    buf.push_back(v);
+    return true;
+}
+
+bool writeVarint(std::vector<uint8_t>& buf, uint32_t v) {
+    while (v >= 0x80) {
+        if (!writeByte(buf, (uint8_t)(v | 0x80))) return false;
+        v >>= 7;
+    }
+    return writeByte(buf, (uint8_t)v);
+}
+
+bool writeSigned(std::vector<uint8_t>& buf, int32_t v) {
+    return writeVarint(buf, ((uint32_t)v << 1) ^ (uint32_t)(v >> 31)); // Zigzag so small negatives stay short
+}
+
+bool writeInt16(std::vector<uint8_t>& buf, int16_t v) {
+    return writeByte(buf, (uint8_t)(v & 0xff)) && writeByte(buf, (uint8_t)((uint16_t)v >> 8));
+}
+
+// Functions to read values back from a packet; they return false on truncation
+bool readByte(const uint8_t* data, int len, int& pos, uint8_t& v) {
+    if (pos >= len) return false;
+    v = data[pos++];
+    return true;
+}
+
+bool readVarint(const uint8_t* data, int len, int& pos, uint32_t& v) {
+    v = 0;
+    for (int shift = 0; shift < 35; shift += 7) {
+        uint8_t b;
+        if (!readByte(data, len, pos, b)) return false;
+        v |= (uint32_t)(b & 0x7f) << shift;
+        if (!(b & 0x80)) return true;
+    }
+    return false;
+}
+
+bool readSigned(const uint8_t* data, int len, int& pos, int32_t& v) {
+    uint32_t u;
+    if (!readVarint(data, len, pos, u)) return false;
+    v = (int32_t)(u >> 1) ^ -(int32_t)(u & 1);
+    return true;
+}
+
+bool readInt16(const uint8_t* data, int len, int& pos, int16_t& v) {
+    uint8_t lo, hi;
+    if (!readByte(data, len, pos, lo) || !readByte(data, len, pos, hi)) return false;
+    v = (int16_t)(uint16_t)(lo | (hi << 8));
+    return true;
+}
+
+// Function to capture the current game state in wire format
+void captureSnapshot(SpectatorSnapshot& snap, uint32_t tick, uint32_t serverMs) {
+    snap.tick = tick;
+    snap.serverMs = serverMs;
+    snap.spacePressed = spacePressed;
+    snap.gameOver = gameOver;
+    snap.score = score;
+    snap.level = level;
+    snap.playerX = quantizePosition(xoffset);
+    snap.playerY = quantizePosition(yoffset);
+    snap.entities.clear();
+
+    // Same draw order as render(): the loose NPCs first, then the active pattern
+    const NPC* loose[] = { &npc1, &npc2, &npc3, &npc4, &npc5, &npc6 };
+    for (const NPC* npc : loose) {
+        snap.entities.push_back({ quantizePosition(npc->x), quantizePosition(npc->y), quantizeByte(npc->size, kSpectatorSizeScale),
+                                  quantizeByte(npc->r, 255.0f), quantizeByte(npc->g, 255.0f), quantizeByte(npc->b, 255.0f) });
+    }
+    for (const auto& npc : *activePattern) {
+        if ((int)snap.entities.size() >= kSpectatorMaxEntities) break;
+        snap.entities.push_back({ quantizePosition(npc.x), quantizePosition(npc.y), quantizeByte(npc.size, kSpectatorSizeScale),
+                                  quantizeByte(npc.r, 255.0f), quantizeByte(npc.g, 255.0f), quantizeByte(npc.b, 255.0f) });
+    }
+}
+
+// Function to write the fields every packet carries
+bool encodeHeader(std::vector<uint8_t>& buf, const SpectatorSnapshot& snap, uint8_t kind) {
+    uint8_t flags = (snap.spacePressed ? 1 : 0) | (snap.gameOver ? 2 : 0);
+    return writeByte(buf, 'P') && writeByte(buf, 'S') && writeByte(buf, kind) && writeByte(buf, flags) &&
+           writeVarint(buf, snap.session) && writeVarint(buf, snap.tick) && writeVarint(buf, snap.serverMs) &&
+           writeSigned(buf, snap.score) && writeSigned(buf, snap.level) && writeByte(buf, snap.epoch);
+}
+
+// Function to encode a full snapshot
+bool encodeKeyframe(std::vector<uint8_t>& buf, const SpectatorSnapshot& snap) {
+    buf.clear();
+    if (!encodeHeader(buf, snap, kSpectatorKeyframe)) return false;
+    if (!writeInt16(buf, snap.playerX) || !writeInt16(buf, snap.playerY)) return false;
+    if (!writeVarint(buf, (uint32_t)snap.entities.size())) return false;
+    for (const auto& e : snap.entities) {
+        if (!writeInt16(buf, e.x) || !writeInt16(buf, e.y) || !writeByte(buf, e.size) ||
+            !writeByte(buf, e.r) || !writeByte(buf, e.g) || !writeByte(buf, e.b)) return false;
+    }
+    return true;
+}
+
+// Function to encode only what changed since the base snapshot (same entity list)
+bool encodeDelta(std::vector<uint8_t>& buf, const SpectatorSnapshot& snap, const SpectatorSnapshot& base) {
+    buf.clear();
+    if (!encodeHeader(buf, snap, kSpectatorDelta)) return false;
+    if (!writeVarint(buf, base.tick)) return false;
+    if (!writeSigned(buf, snap.playerX - base.playerX) || !writeSigned(buf, snap.playerY - base.playerY)) return false;
+
+    int changed = 0;
+    for (size_t i = 0; i < snap.entities.size(); i++) {
+        if (snap.entities[i].x != base.entities[i].x || snap.entities[i].y != base.entities[i].y) changed++;
+    }
+    if (!writeVarint(buf, changed)) return false;
+
+    // Each changed NPC: gap from the previous changed index, a mask of moved axes, then the moves
+    int prevIndex = -1;
+    for (size_t i = 0; i < snap.entities.size(); i++) {
+        const SpectatorEntity& cur = snap.entities[i];
+        const SpectatorEntity& old = base.entities[i];
+        uint8_t mask = (cur.x != old.x ? 1 : 0) | (cur.y != old.y ? 2 : 0);
+        if (!mask) continue;
+        if (!writeVarint(buf, (uint32_t)((int)i - prevIndex - 1)) || !writeByte(buf, mask)) return false;
+        if ((mask & 1) && !writeSigned(buf, cur.x - old.x)) return false;
+        if ((mask & 2) && !writeSigned(buf, cur.y - old.y)) return false;
+        prevIndex = (int)i;
+    }
+    return true;
+}
+
+// Function to apply a received packet to the spectator's latest snapshot.
+// Returns false if the packet is malformed or its delta base is not the one we hold.
+bool decodeSnapshot(const uint8_t* data, int len, SpectatorSnapshot& snap, bool haveBase) {
+    int pos = 0;
+    uint8_t m0, m1, kind, flags, epoch;
+    uint32_t session, tick, serverMs;
+    int32_t newScore, newLevel;
+    if (!readByte(data, len, pos, m0) || !readByte(data, len, pos, m1) || m0 != 'P' || m1 != 'S') return false;
+    if (!readByte(data, len, pos, kind) || !readByte(data, len, pos, flags)) return false;
+    if (!readVarint(data, len, pos, session) || !readVarint(data, len, pos, tick) || !readVarint(data, len, pos, serverMs)) return false;
+    if (!readSigned(data, len, pos, newScore) || !readSigned(data, len, pos, newLevel)) return false;
+    if (!readByte(data, len, pos, epoch)) return false;
+
+    SpectatorSnapshot next;
+    next.session = session;
+    next.tick = tick;
+    next.serverMs = serverMs;
+    next.epoch = epoch;
+    next.spacePressed = (flags & 1) != 0;
+    next.gameOver = (flags & 2) != 0;
+    next.score = newScore;
+    next.level = newLevel;
+
+    if (kind == kSpectatorKeyframe) {
+        uint32_t count;
+        if (!readInt16(data, len, pos, next.playerX) || !readInt16(data, len, pos, next.playerY)) return false;
+        if (!readVarint(data, len, pos, count) || count > (uint32_t)kSpectatorMaxEntities) return false;
+        next.entities.resize(count);
+        for (auto& e : next.entities) {
+            if (!readInt16(data, len, pos, e.x) || !readInt16(data, len, pos, e.y) || !readByte(data, len, pos, e.size) ||
+                !readByte(data, len, pos, e.r) || !readByte(data, len, pos, e.g) || !readByte(data, len, pos, e.b)) return false;
+        }
+    } else if (kind == kSpectatorDelta) {
+        uint32_t baseTick, changed;
+        int32_t dx, dy;
+        if (!readVarint(data, len, pos, baseTick)) return false;
+        if (!haveBase || session != snap.session || baseTick != snap.tick || epoch != snap.epoch) return false; // Lost a packet; wait for a keyframe
+        if (!readSigned(data, len, pos, dx) || !readSigned(data, len, pos, dy)) return false;
+        next.playerX = (int16_t)(snap.playerX + dx);
+        next.playerY = (int16_t)(snap.playerY + dy);
+        next.entities = snap.entities;
+        if (!readVarint(data, len, pos, changed) || changed > (uint32_t)next.entities.size()) return false;
+        int index = -1;
+        for (uint32_t c = 0; c < changed; c++) {
+            uint32_t gap;
+            uint8_t mask;
+            if (!readVarint(data, len, pos, gap) || !readByte(data, len, pos, mask)) return false;
+            if (gap >= (uint32_t)next.entities.size() - (uint32_t)(index + 1)) return false; // Past the last NPC
+            index += (int)gap + 1;
+            if ((mask & 1) && !readSigned(data, len, pos, dx)) return false;
+            if ((mask & 2) && !readSigned(data, len, pos, dy)) return false;
+            if (mask & 1) next.entities[index].x = (int16_t)(next.entities[index].x + dx);
+            if (mask & 2) next.entities[index].y = (int16_t)(next.entities[index].y + dy);
+        }
+    } else {
+        return false;
+    }
+
+    snap = next;
+    return true;
+}
+
+// Function to open a non-blocking UDP socket so the game loop never waits on the network
+int openSpectatorSocket() {
+    int sock = socket(AF_INET, SOCK_DGRAM, 0);
+    if (sock < 0) return -1;
+    int flags = fcntl(sock, F_GETFL, 0);
+    if (flags < 0 || fcntl(sock, F_SETFL, flags | O_NONBLOCK) < 0) {
+        close(sock);
+        return -1;
+    }
+    return sock;
+}
+
+// Function to start broadcasting to host:port (host may be a broadcast address)
+bool startSpectatorServer(const char* host, int port) {
+    memset(&spectatorTarget, 0, sizeof(spectatorTarget));
+    spectatorTarget.sin_family = AF_INET;
+    spectatorTarget.sin_port = htons((uint16_t)port);
+    if (inet_pton(AF_INET, host, &spectatorTarget.sin_addr) != 1) {
+        fprintf(stderr, "Spectator: invalid address %s\n", host);
+        return false;
+    }
+    spectatorSocket = openSpectatorSocket();
+    if (spectatorSocket < 0) {
+        perror("Spectator: socket");
+        return false;
+    }
+    int enable = 1;
+    setsockopt(spectatorSocket, SOL_SOCKET, SO_BROADCAST, &enable, sizeof(enable));
+    spectatorHaveBaseline = false;
+    spectatorLastPattern = nullptr;
+    spectatorTick = 0;
+    std::random_device rd;
+    spectatorSession = rd();
+    return true;
+}
+
+// Function to send this tick's state to spectators; called once per frame after update()
+void broadcastSpectatorState(bool forceKeyframe = false) {
+    if (spectatorSocket < 0) return;
+
+    SpectatorSnapshot snap;
+    captureSnapshot(snap, ++spectatorTick, (uint32_t)(glfwGetTime() * 1000.0));
+    snap.session = spectatorSession;
+
+    // A new pattern (or a different NPC count) means new colors, so start a new keyframe epoch.
+    // The level goes up on every switch, which also catches the same pattern being picked again.
+    bool newEpoch = !spectatorHaveBaseline || activePattern != spectatorLastPattern ||
+                    snap.level != spectatorLastSent.level ||
+                    snap.entities.size() != spectatorLastSent.entities.size();
+    snap.epoch = newEpoch ? (uint8_t)(spectatorLastSent.epoch + 1) : spectatorLastSent.epoch;
+    // Start and game over change the whole screen, so send them in full rather than as a delta
+    bool screenChanged = snap.spacePressed != spectatorLastSent.spacePressed || snap.gameOver != spectatorLastSent.gameOver;
+    bool keyframe = forceKeyframe || newEpoch || screenChanged || spectatorTick % kSpectatorKeyframeInterval == 0;
+
+    std::vector<uint8_t> packet;
+    packet.reserve(kSpectatorMaxPacket);
+    bool encoded = keyframe ? encodeKeyframe(packet, snap) : encodeDelta(packet, snap, spectatorLastSent);
+    if (!encoded && !keyframe) {
+        keyframe = true; // A huge delta is no cheaper than a keyframe
+        encoded = encodeKeyframe(packet, snap);
+    }
+    if (!encoded) return;
+
+    ssize_t sent = sendto(spectatorSocket, packet.data(), packet.size(), MSG_DONTWAIT,
+                          (const sockaddr*)&spectatorTarget, sizeof(spectatorTarget));
+    if (sent < 0) {
+        // Socket buffer full or network down: drop this tick and resync with a keyframe next time
+        spectatorHaveBaseline = false;
+        spectatorLastSent.epoch = snap.epoch;
+        return;
+    }
+    spectatorLastSent = snap;
+    spectatorLastPattern = activePattern;
+    spectatorHaveBaseline = true;
+}
+
+// Function to stop the spectator stream
+void stopSpectatorSocket() {
+    if (spectatorSocket >= 0) {
+        close(spectatorSocket);
+        spectatorSocket = -1;
+    }
+}
+
+// Function to linearly interpolate a quantized coordinate and convert it back to screen units
+float lerpPosition(int16_t a, int16_t b, float t) {
+    return (a + (b - a) * t) / kSpectatorPosScale;
+}
+
+// Function to draw a spectator frame with the same helpers the game uses
+void renderSpectator(const SpectatorSnapshot& from, const SpectatorSnapshot& to, float t, bool connected) {
+    glClear(GL_COLOR_BUFFER_BIT);
+    if (!connected) {
+        renderText("Waiting for game stream...", -0.2f, 0.0f, 1.0f, 1.0f, 1.0f, GLUT_BITMAP_TIMES_ROMAN_24);
+        return;
+    }
+    if (to.gameOver) {
+        renderText("GAME OVER", -0.1f, 0.0f, 1.0f, 0.0f, 0.0f, GLUT_BITMAP_TIMES_ROMAN_24);
+
+        char finalScore[50];
+        sprintf(finalScore, "Final Score: %d", to.score);
+        renderText(finalScore, -0.15f, -0.1f, 1.0f, 1.0f, 1.0f, GLUT_BITMAP_TIMES_ROMAN_24);
+
+        char finalLevel[50];
+        sprintf(finalLevel, "Final Level: %d", to.level);
+        renderText(finalLevel, -0.15f, -0.2f, 1.0f, 1.0f, 1.0f, GLUT_BITMAP_TIMES_ROMAN_24);
+    }
+    if (!to.spacePressed) {
+        renderText("Pixel Peril!", -0.1f, 0.1f, 1.0f, 0.0f, 0.0f, GLUT_BITMAP_HELVETICA_18);
+        renderText("Waiting for the player to start", -0.2f, 0.0f, 1.0f, 1.0f, 1.0f, GLUT_BITMAP_TIMES_ROMAN_24);
+        return;
+    }
+
+    char scoreText[50];
+    sprintf(scoreText, "Score: %d", to.score);
+    renderText(scoreText, -0.15f, -0.9f, 1.0f, 1.0f, 1.0f, GLUT_BITMAP_TIMES_ROMAN_24);
+
+    char levelText[50];
+    sprintf(levelText, "Level: %d", to.level);
+    renderText(levelText, 0.05f, -0.9f, 1.0f, 1.0f, 1.0f, GLUT_BITMAP_TIMES_ROMAN_24);
+
+    // The player is drawn as a white NPC at the same spot render() draws the square
+    renderNPC(NPC(lerpPosition(from.playerX, to.playerX, t), -0.9f + lerpPosition(from.playerY, to.playerY, t),
+                  0.07f, 1.0f, 1.0f, 1.0f, 0.0f));
+
+    // Interpolate only within one epoch; across a pattern switch just show the newer one
+    bool blend = from.epoch == to.epoch && from.entities.size() == to.entities.size();
+    for (size_t i = 0; i < to.entities.size(); i++) {
+        const SpectatorEntity& b = to.entities[i];
+        const SpectatorEntity& a = blend ? from.entities[i] : b;
+        renderNPC(NPC(lerpPosition(a.x, b.x, t), lerpPosition(a.y, b.y, t), b.size / kSpectatorSizeScale,
+                      b.r / 255.0f, b.g / 255.0f, b.b / 255.0f, 0.0f));
+    }
+}
+
+// Function to run the spectator client: receive snapshots and render them slightly in the past
+int runSpectator(GLFWwindow* window, int port) {
+    spectatorSocket = openSpectatorSocket();
+    if (spectatorSocket < 0) {
+        perror("Spectator: socket");
+        return -1;
+    }
+    sockaddr_in addr;
+    memset(&addr, 0, sizeof(addr));
+    addr.sin_family = AF_INET;
+    addr.sin_port = htons((uint16_t)port);
+    addr.sin_addr.s_addr = htonl(INADDR_ANY);
+    if (bind(spectatorSocket, (const sockaddr*)&addr, sizeof(addr)) < 0) {
+        perror("Spectator: bind");
+        stopSpectatorSocket();
+        return -1;
+    }
+
+    SpectatorSnapshot latest; // Newest decoded state, the base for incoming deltas
+    bool haveLatest = false;
+    std::vector<SpectatorSnapshot> history; // Recent snapshots ordered by server time
+    double clockOffset = 0.0; // Local ms minus server ms, tracked from arrivals
+    double lastPacketMs = 0.0; // Local time of the last packet we could use
+
+    while (!glfwWindowShouldClose(window)) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1)); // Sleep to cap frame rate
+        double localMs = glfwGetTime() * 1000.0;
+
+        // Drain whatever arrived since the last frame without blocking
+        uint8_t packet[kSpectatorMaxPacket];
+        for (int i = 0; i < 256; i++) {
+            ssize_t len = recv(spectatorSocket, packet, sizeof(packet), MSG_DONTWAIT);
+            if (len <= 0) break;
+            SpectatorSnapshot candidate = latest;
+            if (!decodeSnapshot(packet, (int)len, candidate, haveLatest)) continue;
+            bool newSession = !haveLatest || candidate.session != latest.session; // A new game process started
+            if (!newSession && candidate.tick <= latest.tick) continue; // Stale or reordered
+            if (newSession) history.clear();
+
+            // Jump to earlier arrivals at once (less network delay), drift slowly towards later ones
+            double sample = localMs - candidate.serverMs;
+            if (newSession || sample < clockOffset) clockOffset = sample;
+            else clockOffset += (sample - clockOffset) * 0.01;
+
+            latest = candidate;
+            haveLatest = true;
+            lastPacketMs = localMs;
+            history.push_back(candidate);
+        }
+
+        // The game went quiet mid-game (closed or crashed): go back to the waiting screen.
+        // A finished game keeps its final score up until a new session starts streaming.
+        if (haveLatest && !latest.gameOver && localMs - lastPacketMs > kSpectatorTimeoutMs) {
+            latest = SpectatorSnapshot();
+            haveLatest = false;
+            history.clear();
+        }
+
+        // Drop snapshots too old to blend from, keeping one before the render time
+        double renderMs = localMs - clockOffset - kSpectatorInterpDelayMs;
+        size_t expired = 0;
+        while (expired + 1 < history.size() && history[expired + 1].serverMs < renderMs - kSpectatorHistoryMarginMs) expired++;
+        if (history.size() - expired > 4096) expired = history.size() - 4096; // Memory guard against a bogus server clock
+        history.erase(history.begin(), history.begin() + expired);
+
+        // Pick the two snapshots around the render time and blend between them
+        size_t to = 0;
+        while (to + 1 < history.size() && history[to].serverMs < renderMs) to++;
+        size_t from = to > 0 ? to - 1 : to;
+        float t = 1.0f;
+        if (from != to && history[to].serverMs > history[from].serverMs) {
+            t = (float)((renderMs - history[from].serverMs) / (history[to].serverMs - history[from].serverMs));
+            if (t < 0.0f) t = 0.0f;
+            if (t > 1.0f) t = 1.0f;
+        }
+        if (history.empty()) {
+            renderSpectator(latest, latest, 1.0f, false);
+        } else {
+            renderSpectator(history[from], history[to], t, true);
+        }
+
+        glfwSwapBuffers(window);
+        glfwPollEvents();
+        if (glfwGetKey(window, GLFW_KEY_ESCAPE) == GLFW_PRESS)
+            break;
+    }
+
+    stopSpectatorSocket();
+    return 0;
+}
+
+// Function to parse a UDP port number; returns false unless it is a whole number in 1..65535
+bool parsePort(const char* text, int& port) {
+    char* end = nullptr;
+    errno = 0;
+    long value = strtol(text, &end, 10);
+    if (end == text || *end != '\0' || errno == ERANGE || value < 1 || value > 65535) {
+        fprintf(stderr, "Spectator: invalid port %s\n", text);
+        return false;
+    }
+    port = (int)value;
+    return true;
+}
+
+// Function to split "host:port" (either part optional) into its pieces
+bool parseHostPort(const char* arg, std::string& host, int& port) {
+    std::string s = arg;
+    size_t colon = s.find(':');
+    if (colon == std::string::npos) {
+        if (!s.empty()) host = s;
+        return true;
+    }
+    if (colon > 0) host = s.substr(0, colon);
+    if (colon + 1 < s.size()) return parsePort(s.c_str() + colon + 1, port);
+    return true;
+}
+
 int main(int argc, char** argv) {
     GLFWwindow* window;
 
@@ -626,8 +1150,31 @@ int main(int argc, char** argv) {
         return -1;
 
     glutInit(&argc, argv);
+
+    /* Spectator options: --serve [host][:port] broadcasts, --spectate [port] watches */
+    bool serve = false;
+    bool spectate = false;
+    std::string spectatorHost = "127.0.0.1";
+    int spectatorPort = kSpectatorDefaultPort;
+    for (int i = 1; i < argc; i++) {
+        bool hasValue = i + 1 < argc && argv[i + 1][0] != '-';
+        if (strcmp(argv[i], "--serve") == 0) {
+            serve = true;
+            if (hasValue && !parseHostPort(argv[++i], spectatorHost, spectatorPort)) {
+                glfwTerminate();
+                return -1;
+            }
+        } else if (strcmp(argv[i], "--spectate") == 0) {
+            spectate = true;
+            if (hasValue && !parsePort(argv[++i], spectatorPort)) {
+                glfwTerminate();
+                return -1;
+            }
+        }
+    }
+
     /* Create a windowed mode window and its OpenGL context */
-    window = glfwCreateWindow(1700, 950, "Pixel Peril!", NULL, NULL);
+    window = glfwCreateWindow(1700, 950, spectate ? "Pixel Peril! (Spectator)" : "Pixel Peril!", NULL, NULL);
     if (!window) {
         glfwTerminate();
         return -1;
@@ -636,6 +1183,18 @@ int main(int argc, char** argv) {
     /* Make the window's context current */
     glfwMakeContextCurrent(window);
 
+    if (spectate) {
+        int result = runSpectator(window, spectatorPort);
+        glfwDestroyWindow(window);
+        glfwTerminate();
+        return result;
+    }
+    if (serve && !startSpectatorServer(spectatorHost.c_str(), spectatorPort)) {
+        glfwDestroyWindow(window);
+        glfwTerminate();
+        return -1;
+    }
+
     /* Main loop */
     bool running = true;
     while (running && !glfwWindowShouldClose(window)&& !gameOver) {
@@ -643,6 +1202,7 @@ int main(int argc, char** argv) {
 
         update(window);   // Update game logic
         render();   // Render the scene
+        broadcastSpectatorState(); // Send this tick to spectators (no-op unless --serve)
 
         glfwSwapBuffers(window); // Swap front and back buffers
         glfwPollEvents();        // Poll for and process events
@@ -657,6 +1217,10 @@ int main(int argc, char** argv) {
     }
 }
         if (gameOver) {
+            // The loop stops sending after this, so repeat the final state in case a packet is lost
+            for (int i = 0; i < kSpectatorGameOverResends; i++) {
+                broadcastSpectatorState(true);
+            }
             if (glfwGetKey(window, GLFW_KEY_R) == GLFW_PRESS) {
                 resetGame(); // Reset the game to its initial state
             }
@@ -668,6 +1232,7 @@ int main(int argc, char** argv) {
     }
 
     /* Cleanup */
+    stopSpectatorSocket();
     glfwDestroyWindow(window);
     glfwTerminate();
     return 0;